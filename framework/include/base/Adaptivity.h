@@ -308,6 +308,8 @@ protected:
   PerfID _uniform_refine_timer;
   PerfID _uniform_refine_with_projection;
   PerfID _update_error_vectors;
+  PerfID _flag_elements_timer;
+  PerfID _refine_and_coarsen_timer;
 };
 
 template <typename T>
@@ -267,4 +267,12 @@ private:
 
   /// Whether this object will be generating a mortar segment mesh for periodic constraints
   const bool _periodic;
+
+  /**
+   * The active lower-dimensional slave and master elements, in mesh iteration order. These are
+   * collected by buildNodeToElemMaps() so that the later stages of the mortar segment mesh
+   * generation only visit the interface rather than every element of the (volume) mesh.
+   */
+  std::vector<const Elem *> _active_slave_lower_elems;
+  std::vector<const Elem *> _active_master_lower_elems;
 };
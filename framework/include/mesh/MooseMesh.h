@@ -982,7 +982,7 @@ protected:
   std::vector<BndNode> _extra_bnd_nodes;
 
   /// list of nodes that belongs to a specified block (domain)
-  std::map<dof_id_type, std::set<SubdomainID>> _block_node_list;
+  std::unordered_map<dof_id_type, std::set<SubdomainID>> _block_node_list;
 
   /// list of nodes that belongs to a specified nodeset: indexing [nodeset_id] -> [array of node ids]
   std::map<boundary_id_type, std::vector<dof_id_type>> _node_set_nodes;
@@ -10,6 +10,7 @@
 #pragma once
 
 #include "MeshGenerator.h"
+#include "libmesh/replicated_mesh.h"
 
 // Forward declarations
 class TiledMeshGenerator;
@@ -28,6 +29,20 @@ public:
   std::unique_ptr<MeshBase> generate() override;
 
 protected:
+  /**
+   * Repeats a mesh n_tiles times along one direction
+   * @param mesh The mesh to repeat, which receives the tiles
+   * @param n_tiles The total number of tiles, including the original mesh
+   * @param width The offset between two consecutive tiles
+   * @param this_boundary The boundary of a tile that is stitched to the next tile
+   * @param other_boundary The boundary of the next tile that is stitched to the previous one
+   */
+  void tile(ReplicatedMesh & mesh,
+            unsigned int n_tiles,
+            const RealVectorValue & width,
+            boundary_id_type this_boundary,
+            boundary_id_type other_boundary) const;
+
   /// Mesh that possibly comes from another generator
   std::unique_ptr<MeshBase> & _input;
 
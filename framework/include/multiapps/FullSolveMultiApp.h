@@ -28,6 +28,12 @@ public:
 
   virtual void initialSetup() override;
 
+  /**
+   * Reassigns the Apps to processors based on the solve times measured during the previous time
+   * step when "rebalance_apps" is set.
+   */
+  virtual void preTransfer(Real dt, Real target_time) override;
+
   virtual bool solveStep(Real dt, Real target_time, bool auto_advance = true) override;
 
   virtual void postExecute() override
@@ -40,5 +46,17 @@ public:
 
 private:
   std::vector<Executioner *> _executioners;
+
+  /// Whether or not to reassign the Apps to processors based on their measured solve time
+  const bool _rebalance_apps;
+
+  /// Relative reduction of the slowest processor time required to reassign the Apps
+  const Real _rebalance_tolerance;
+
+  /// The wall time of the last solve of each local App
+  std::vector<Real> _solve_times;
+
+  /// The target time of the last solve
+  Real _solve_target_time;
 };
 
@@ -295,6 +295,47 @@ protected:
    */
   void buildComm();
 
+  /**
+   * Assign a contiguous range of Apps to this processor such that the sum of the "app_costs" is
+   * balanced across all processors.  Only valid when there are at least as many Apps as
+   * processors.  The resulting assignment is printed to the console.
+   */
+  void buildCostBalancedRange();
+
+  /**
+   * Split the Apps into contiguous ranges, one for each processor, such that the sum of the
+   * costs in each range is balanced.  Only valid when there are at least as many Apps as
+   * processors.
+   *
+   * @param costs The cost of each global App
+   * @return The first global App of each processor followed by the total number of Apps
+   */
+  std::vector<unsigned int> costBalancedRanges(const std::vector<Real> & costs) const;
+
+  /**
+   * Print the range of Apps assigned to each processor along with its total cost.
+   *
+   * @param begin The first global App of each processor followed by the total number of Apps
+   * @param costs The cost of each global App
+   */
+  void printAppAssignment(const std::vector<unsigned int> & begin, const std::vector<Real> & costs);
+
+  /**
+   * Reassign the Apps to processors such that the supplied costs are balanced.  Apps that change
+   * processor are backed up, their Backup is sent to the new processor, and they are recreated
+   * there.  The recreated Apps still need to be set up and restored from their entry in
+   * _backups by the caller.  Must be called on all processors and only when there are at least
+   * as many Apps as processors.
+   *
+   * @param costs The cost of each global App, which must be the same on all processors
+   * @param tolerance The relative reduction of the largest processor cost required to move Apps
+   * @param created_apps Filled with the local numbers of the Apps that were recreated
+   * @return Whether or not the Apps were reassigned
+   */
+  bool redistributeApps(const std::vector<Real> & costs,
+                        Real tolerance,
+                        std::vector<unsigned int> & created_apps);
+
   /**
    * Map a global App number to the local number.
    * Note: This will error if given a global number that doesn't map to a local number.
@@ -387,6 +428,9 @@ protected:
   /// Maximum number of processors to give to each app
   unsigned int _max_procs_per_app;
 
+  /// Relative cost of each App used for distributing Apps over processors
+  const std::vector<Real> _app_costs;
+
   /// Whether or not to move the output of the MultiApp into position
   bool _output_in_position;
 
@@ -1996,6 +1996,7 @@ private:
   const PerfID _update_mesh_xfem_timer;
   const PerfID _mesh_changed_timer;
   const PerfID _mesh_changed_helper_timer;
+  const PerfID _project_material_properties_timer;
   const PerfID _check_problem_integrity_timer;
   const PerfID _serialize_solution_timer;
   const PerfID _check_nonlinear_convergence_timer;
@@ -18,6 +18,8 @@
 #include "RankTwoTensor.h"
 #include "RankThreeTensor.h"
 #include "RankFourTensor.h"
+#include "SymmetricRankTwoTensor.h"
+#include "SymmetricRankFourTensor.h"
 #include "MooseADWrapper.h"
 
 #include "libmesh/parallel.h"
@@ -414,6 +416,20 @@ dataStore(std::ostream & stream, RankFourTensorTempl<T> & rft, void * context)
   dataStore(stream, rft._vals, context);
 }
 
+template <typename T>
+void
+dataStore(std::ostream & stream, SymmetricRankTwoTensorTempl<T> & srtt, void * context)
+{
+  dataStore(stream, srtt._vals, context);
+}
+
+template <typename T>
+void
+dataStore(std::ostream & stream, SymmetricRankFourTensorTempl<T> & srft, void * context)
+{
+  dataStore(stream, srft._vals, context);
+}
+
 template <typename T>
 inline void
 dataStore(std::ostream & stream, MooseADWrapper<T> & dn_wrapper, void * context)
@@ -665,6 +681,20 @@ dataLoad(std::istream & stream, RankFourTensorTempl<T> & rft, void * context)
   dataLoad(stream, rft._vals, context);
 }
 
+template <typename T>
+void
+dataLoad(std::istream & stream, SymmetricRankTwoTensorTempl<T> & srtt, void * context)
+{
+  dataLoad(stream, srtt._vals, context);
+}
+
+template <typename T>
+void
+dataLoad(std::istream & stream, SymmetricRankFourTensorTempl<T> & srft, void * context)
+{
+  dataLoad(stream, srft._vals, context);
+}
+
 template <typename T>
 inline void
 dataLoad(std::istream & stream, MooseADWrapper<T> & dn_wrapper, void * context)
@@ -310,6 +310,13 @@ protected:
    */
   bool updateExodusBracketingTimeIndices(Real time);
 
+  /**
+   * Copies the nodal, elemental and scalar variables of one ExodusII time step into a system
+   * @param system The system receiving the data
+   * @param step The one-based ExodusII time step to read
+   */
+  void readExodusIITimeStep(System & system, int step);
+
   /**
    * A wrapper method for calling the various MeshFunctions used for reading the data
    * @param p The location at which data is desired
@@ -119,6 +119,14 @@ class RankFourTensorTempl;
 typedef RankFourTensorTempl<Real> RankFourTensor;
 typedef RankFourTensorTempl<DualReal> DualRankFourTensor;
 template <typename>
+class SymmetricRankTwoTensorTempl;
+typedef SymmetricRankTwoTensorTempl<Real> SymmetricRankTwoTensor;
+typedef SymmetricRankTwoTensorTempl<DualReal> DualSymmetricRankTwoTensor;
+template <typename>
+class SymmetricRankFourTensorTempl;
+typedef SymmetricRankFourTensorTempl<Real> SymmetricRankFourTensor;
+typedef SymmetricRankFourTensorTempl<DualReal> DualSymmetricRankFourTensor;
+template <typename>
 class MaterialProperty;
 template <typename>
 class ADMaterialPropertyObject;
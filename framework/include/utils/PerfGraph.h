@@ -18,6 +18,7 @@
 
 // System Includes
 #include <array>
+#include <thread>
 
 // Forward Declarations
 class PerfGuard;
@@ -221,6 +222,16 @@ protected:
                                      FullTable & vtable,
                                      unsigned int current_depth = 0);
 
+  /**
+   * Whether or not the caller is on the thread that created this graph
+   *
+   * The call stack is not thread safe, so push() and pop() are ignored on any other thread
+   * and sections timed off of the main thread are dropped.  Depending on the threading backend
+   * the main thread may only wait on the workers, so a section timed inside of a threaded loop
+   * can record no calls at all.
+   */
+  bool onMainThread() const { return std::this_thread::get_id() == _main_thread_id; }
+
   /**
    * Updates the cumulative self/children/total time
    *
@@ -252,6 +263,9 @@ protected:
   /// The full callstack.  Currently capped at a depth of 100
   std::array<PerfNode *, MAX_STACK_SIZE> _stack;
 
+  /// The thread that owns the call stack
+  const std::thread::id _main_thread_id;
+
   /// Map of section names to IDs
   std::map<std::string, PerfID> _section_name_to_id;
 
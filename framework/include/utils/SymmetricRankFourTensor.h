@@ -0,0 +1,160 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#pragma once
+
+#include "SymmetricRankTwoTensor.h"
+
+// Forward declarations
+template <typename>
+class RankFourTensorTempl;
+
+template <typename T>
+void mooseSetToZero(T & v);
+
+/**
+ * Helper function template specialization to set an object to zero.
+ * Needed by DerivativeMaterialInterface
+ */
+template <>
+void mooseSetToZero<SymmetricRankFourTensorTempl<Real>>(SymmetricRankFourTensorTempl<Real> & v);
+template <>
+void
+mooseSetToZero<SymmetricRankFourTensorTempl<DualReal>>(SymmetricRankFourTensorTempl<DualReal> & v);
+
+/**
+ * SymmetricRankFourTensorTempl is a compact storage class for fourth order tensors with the minor
+ * symmetries C_ijkl = C_jikl = C_ijlk, such as elasticity tensors and consistent tangents.
+ *
+ * The tensor is stored as a 6x6 matrix in Mandel notation, i.e. 36 instead of 81 entries, with
+ * the rows and columns ordered like the components of SymmetricRankTwoTensorTempl. The major
+ * symmetry C_ijkl = C_klij is not assumed. In this form the contraction C_ijkl A_kl is a 6x6
+ * matrix-vector product, C_ijpq D_pqkl is a 6x6 matrix product, and the inverse with respect to
+ * the symmetric identity is the matrix inverse.
+ */
+template <typename T>
+class SymmetricRankFourTensorTempl
+{
+public:
+  /// Number of rows and columns of the Mandel matrix
+  static constexpr unsigned int N = 6;
+  static constexpr unsigned int N2 = N * N;
+
+  /// Initialization method
+  enum InitMethod
+  {
+    initNone,
+    initIdentitySymmetricFour
+  };
+
+  /// Default constructor; fills to zero
+  SymmetricRankFourTensorTempl();
+
+  /// Select specific initialization pattern
+  SymmetricRankFourTensorTempl(const InitMethod);
+
+  /// Initialize from a full rank four tensor, averaging over the minor symmetries
+  explicit SymmetricRankFourTensorTempl(const RankFourTensorTempl<T> & a);
+
+  /// Convert to a full rank four tensor
+  RankFourTensorTempl<T> toRankFourTensor() const;
+
+  /// Gets the value for the index specified. Takes index = 0,1,2
+  T operator()(unsigned int i, unsigned int j, unsigned int k, unsigned int l) const;
+
+  /// Mandel matrix entry (a, b) with a, b = 0..5
+  inline T & operator()(unsigned int a, unsigned int b) { return _vals[a * N + b]; }
+
+  /// Mandel matrix entry (a, b) with a, b = 0..5
+  inline const T & operator()(unsigned int a, unsigned int b) const { return _vals[a * N + b]; }
+
+  /// Sets all components to zero
+  void zero();
+
+  /// Prints the Mandel matrix
+  void print(std::ostream & stm = Moose::out) const;
+
+  /// C_ijkl + a_ijkl
+  SymmetricRankFourTensorTempl<T> operator+(const SymmetricRankFourTensorTempl<T> & a) const;
+
+  /// C_ijkl += a_ijkl
+  SymmetricRankFourTensorTempl<T> & operator+=(const SymmetricRankFourTensorTempl<T> & a);
+
+  /// C_ijkl - a_ijkl
+  SymmetricRankFourTensorTempl<T> operator-(const SymmetricRankFourTensorTempl<T> & a) const;
+
+  /// C_ijkl -= a_ijkl
+  SymmetricRankFourTensorTempl<T> & operator-=(const SymmetricRankFourTensorTempl<T> & a);
+
+  /// C_ijkl * a
+  SymmetricRankFourTensorTempl<T> operator*(const T & a) const;
+
+  /// C_ijkl *= a
+  SymmetricRankFourTensorTempl<T> & operator*=(const T & a);
+
+  /// C_ijkl / a
+  SymmetricRankFourTensorTempl<T> operator/(const T & a) const;
+
+  /// C_ijkl /= a
+  SymmetricRankFourTensorTempl<T> & operator/=(const T & a);
+
+  /// C_ijkl * a_kl
+  SymmetricRankTwoTensorTempl<T> operator*(const SymmetricRankTwoTensorTempl<T> & a) const;
+
+  /// C_ijpq * a_pqkl
+  SymmetricRankFourTensorTempl<T> operator*(const SymmetricRankFourTensorTempl<T> & a) const;
+
+  /// sqrt(C_ijkl * C_ijkl)
+  T L2norm() const;
+
+  /// C_klij
+  SymmetricRankFourTensorTempl<T> transposeMajor() const;
+
+  /**
+   * This returns A_ijkl such that C_ijkl*A_klmn = 0.5*(de_im de_jn + de_in de_jm)
+   * (only implemented for Real)
+   */
+  SymmetricRankFourTensorTempl<T> invSymm() const;
+
+  /**
+   * Fill with the isotropic tensor
+   * C_ijkl = lambda*de_ij*de_kl + mu*(de_ik*de_jl + de_il*de_jk)
+   * @param lambda first Lame modulus
+   * @param mu second (shear) Lame modulus
+   */
+  void fillSymmetricIsotropic(const T & lambda, const T & mu);
+
+  /**
+   * Fill with the isotropic elasticity tensor for Young's modulus E and Poisson's ratio nu
+   */
+  void fillSymmetricIsotropicEandNu(const T & E, const T & nu);
+
+  /// checks if the tensor has the major symmetry C_ijkl = C_klij
+  bool isSymmetric() const;
+
+protected:
+  /// The Mandel matrix stored row by row
+  T _vals[N2];
+
+  template <class T2>
+  friend void dataStore(std::ostream &, SymmetricRankFourTensorTempl<T2> &, void *);
+
+  template <class T2>
+  friend void dataLoad(std::istream &, SymmetricRankFourTensorTempl<T2> &, void *);
+};
+
+typedef SymmetricRankFourTensorTempl<Real> SymmetricRankFourTensor;
+typedef SymmetricRankFourTensorTempl<DualReal> DualSymmetricRankFourTensor;
+
+template <typename T>
+inline SymmetricRankFourTensorTempl<T>
+operator*(const T & a, const SymmetricRankFourTensorTempl<T> & b)
+{
+  return b * a;
+}
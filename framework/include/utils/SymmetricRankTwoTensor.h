@@ -0,0 +1,157 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#pragma once
+
+#include "Moose.h"
+#include "DualReal.h"
+
+#include "libmesh/libmesh.h"
+
+#include <ostream>
+
+using libMesh::Real;
+
+// Forward declarations
+template <typename>
+class RankTwoTensorTempl;
+template <typename>
+class SymmetricRankTwoTensorTempl;
+template <typename>
+class SymmetricRankFourTensorTempl;
+
+template <typename T>
+void mooseSetToZero(T & v);
+
+/**
+ * Helper function template specialization to set an object to zero.
+ * Needed by DerivativeMaterialInterface
+ */
+template <>
+void mooseSetToZero<SymmetricRankTwoTensorTempl<Real>>(SymmetricRankTwoTensorTempl<Real> & v);
+template <>
+void
+mooseSetToZero<SymmetricRankTwoTensorTempl<DualReal>>(SymmetricRankTwoTensorTempl<DualReal> & v);
+
+/**
+ * SymmetricRankTwoTensorTempl is a compact storage class for symmetric second order tensors
+ * such as stress and strain.
+ *
+ * Only the 6 independent components are stored, in Mandel notation:
+ * (A_11, A_22, A_33, sqrt(2) A_23, sqrt(2) A_13, sqrt(2) A_12)
+ * The sqrt(2) factors make the double contraction A_ij B_ij a plain dot product of the stored
+ * components and allow SymmetricRankFourTensorTempl to be applied as a 6x6 matrix.
+ */
+template <typename T>
+class SymmetricRankTwoTensorTempl
+{
+public:
+  /// Number of independent components
+  static constexpr unsigned int N = 6;
+
+  /// Initialization method
+  enum InitMethod
+  {
+    initNone,
+    initIdentity
+  };
+
+  /// Default constructor; fills to zero
+  SymmetricRankTwoTensorTempl();
+
+  /// Select specific initialization pattern
+  SymmetricRankTwoTensorTempl(const InitMethod);
+
+  /// Initialize from the physical (non-Mandel) components S11, S22, S33, S23, S13, S12
+  SymmetricRankTwoTensorTempl(
+      const T & S11, const T & S22, const T & S33, const T & S23, const T & S13, const T & S12);
+
+  /// Initialize from the symmetric part of a full rank two tensor
+  explicit SymmetricRankTwoTensorTempl(const RankTwoTensorTempl<T> & a);
+
+  /// Convert to a full rank two tensor
+  RankTwoTensorTempl<T> toRankTwoTensor() const;
+
+  /// Gets the value for the index specified. Takes index = 0,1,2
+  T operator()(unsigned int i, unsigned int j) const;
+
+  /// Mandel component a = 0..5 of the tensor
+  inline T & operator()(unsigned int a) { return _vals[a]; }
+
+  /// Mandel component a = 0..5 of the tensor
+  inline const T & operator()(unsigned int a) const { return _vals[a]; }
+
+  /// Sets all components to zero
+  void zero();
+
+  /// Prints the physical components of the tensor
+  void print(std::ostream & stm = Moose::out) const;
+
+  /// A_ij + B_ij
+  SymmetricRankTwoTensorTempl<T> operator+(const SymmetricRankTwoTensorTempl<T> & b) const;
+
+  /// A_ij += B_ij
+  SymmetricRankTwoTensorTempl<T> & operator+=(const SymmetricRankTwoTensorTempl<T> & b);
+
+  /// A_ij - B_ij
+  SymmetricRankTwoTensorTempl<T> operator-(const SymmetricRankTwoTensorTempl<T> & b) const;
+
+  /// A_ij -= B_ij
+  SymmetricRankTwoTensorTempl<T> & operator-=(const SymmetricRankTwoTensorTempl<T> & b);
+
+  /// -A_ij
+  SymmetricRankTwoTensorTempl<T> operator-() const;
+
+  /// A_ij * a
+  SymmetricRankTwoTensorTempl<T> operator*(const T & a) const;
+
+  /// A_ij *= a
+  SymmetricRankTwoTensorTempl<T> & operator*=(const T & a);
+
+  /// A_ij / a
+  SymmetricRankTwoTensorTempl<T> operator/(const T & a) const;
+
+  /// A_ij /= a
+  SymmetricRankTwoTensorTempl<T> & operator/=(const T & a);
+
+  /// A_ij * B_ij
+  T doubleContraction(const SymmetricRankTwoTensorTempl<T> & b) const;
+
+  /// A_ii
+  T trace() const;
+
+  /// The deviatoric part A_ij - A_kk delta_ij / 3
+  SymmetricRankTwoTensorTempl<T> deviatoric() const;
+
+  /// sqrt(A_ij * A_ij)
+  T L2norm() const;
+
+protected:
+  /// The Mandel components of the tensor
+  T _vals[N];
+
+  template <class T2>
+  friend void dataStore(std::ostream &, SymmetricRankTwoTensorTempl<T2> &, void *);
+
+  template <class T2>
+  friend void dataLoad(std::istream &, SymmetricRankTwoTensorTempl<T2> &, void *);
+
+  template <typename T2>
+  friend class SymmetricRankFourTensorTempl;
+};
+
+typedef SymmetricRankTwoTensorTempl<Real> SymmetricRankTwoTensor;
+typedef SymmetricRankTwoTensorTempl<DualReal> DualSymmetricRankTwoTensor;
+
+template <typename T>
+inline SymmetricRankTwoTensorTempl<T>
+operator*(const T & a, const SymmetricRankTwoTensorTempl<T> & b)
+{
+  return b * a;
+}
@@ -27,6 +27,7 @@ public:
   virtual ~FluidPropertiesMaterialPT();
 
 protected:
+  virtual void computeProperties();
   virtual void computeQpProperties();
 
   /// Pressure (Pa)
@@ -54,5 +55,12 @@ protected:
 
   /// Fluid properties UserObject
   const SinglePhaseFluidProperties & _fp;
+
+  ///@{ Pressure, temperature, density and internal energy at all of the quadrature points
+  std::vector<Real> _pressure_qps;
+  std::vector<Real> _temperature_qps;
+  std::vector<Real> _rho_qps;
+  std::vector<Real> _e_qps;
+  ///@}
 };
 
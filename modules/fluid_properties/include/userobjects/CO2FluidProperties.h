@@ -52,6 +52,7 @@ public:
 
   virtual void rho_from_p_T(
       Real pressure, Real temperature, Real & rho, Real & drho_dp, Real & drho_dT) const override;
+  using HelmholtzFluidProperties::rho_from_p_T;
 
   virtual Real mu_from_p_T(Real pressure, Real temperature) const override;
 
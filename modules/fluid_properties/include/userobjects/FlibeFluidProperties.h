@@ -128,6 +128,7 @@ public:
    */
   virtual void
   rho_from_p_T(Real p, Real T, Real & rho, Real & drho_dp, Real & drho_dT) const override;
+  using SinglePhaseFluidProperties::rho_from_p_T;
 
   /**
    * Specific volume from pressure and temperature
@@ -190,6 +191,7 @@ public:
    * @param[out] de_dT   derivative of specific internal energy w.r.t. temperature
    */
   virtual void e_from_p_T(Real p, Real T, Real & e, Real & de_dp, Real & de_dT) const override;
+  using SinglePhaseFluidProperties::e_from_p_T;
 
   /**
    * Isobaric specific heat capacity from pressure and temperature
@@ -187,6 +187,8 @@ public:
                             DualReal & rho,
                             DualReal & drho_dp,
                             DualReal & drho_dT) const override;
+  using SinglePhaseFluidProperties::rho_from_p_T;
+
   /**
    * Specific internal energy from pressure and temperature
    *
@@ -206,6 +208,7 @@ public:
    * @param[out] de_dT   derivative of specific internal energy w.r.t. temperature
    */
   virtual void e_from_p_T(Real p, Real T, Real & e, Real & de_dp, Real & de_dT) const override;
+  using SinglePhaseFluidProperties::e_from_p_T;
 
   /**
    * Specific enthalpy from pressure and temperature
@@ -65,6 +65,14 @@ public:
   virtual Real rho_from_p_T(Real p, Real T) const override;
   virtual void
   rho_from_p_T(Real p, Real T, Real & rho, Real & drho_dp, Real & drho_dT) const override;
+  virtual void rho_from_p_T(const std::vector<Real> & p,
+                            const std::vector<Real> & T,
+                            std::vector<Real> & rho) const override;
+  virtual void rho_from_p_T(const std::vector<Real> & p,
+                            const std::vector<Real> & T,
+                            std::vector<Real> & rho,
+                            std::vector<Real> & drho_dp,
+                            std::vector<Real> & drho_dT) const override;
   virtual void rho_from_p_T(const DualReal & p,
                             const DualReal & T,
                             DualReal & rho,
@@ -88,6 +96,14 @@ public:
   virtual void h_from_p_T(Real p, Real T, Real & h, Real & dh_dp, Real & dh_dT) const override;
   virtual Real e_from_p_T(Real p, Real T) const override;
   virtual void e_from_p_T(Real p, Real T, Real & e, Real & de_dp, Real & de_dT) const override;
+  virtual void e_from_p_T(const std::vector<Real> & p,
+                          const std::vector<Real> & T,
+                          std::vector<Real> & e) const override;
+  virtual void e_from_p_T(const std::vector<Real> & p,
+                          const std::vector<Real> & T,
+                          std::vector<Real> & e,
+                          std::vector<Real> & de_dp,
+                          std::vector<Real> & de_dT) const override;
   virtual Real p_from_h_s(Real h, Real s) const override;
   virtual void p_from_h_s(Real h, Real s, Real & p, Real & dp_dh, Real & dp_ds) const override;
   virtual Real g_from_v_e(Real v, Real e) const override;
@@ -73,11 +73,31 @@ public:
   virtual void rho_from_p_T(
       Real pressure, Real temperature, Real & rho, Real & drho_dp, Real & drho_dT) const override;
 
+  virtual void rho_from_p_T(const std::vector<Real> & pressure,
+                            const std::vector<Real> & temperature,
+                            std::vector<Real> & rho) const override;
+
+  virtual void rho_from_p_T(const std::vector<Real> & pressure,
+                            const std::vector<Real> & temperature,
+                            std::vector<Real> & rho,
+                            std::vector<Real> & drho_dp,
+                            std::vector<Real> & drho_dT) const override;
+
   virtual Real e_from_p_T(Real pressure, Real temperature) const override;
 
   virtual void
   e_from_p_T(Real pressure, Real temperature, Real & e, Real & de_dp, Real & de_dT) const override;
 
+  virtual void e_from_p_T(const std::vector<Real> & pressure,
+                          const std::vector<Real> & temperature,
+                          std::vector<Real> & e) const override;
+
+  virtual void e_from_p_T(const std::vector<Real> & pressure,
+                          const std::vector<Real> & temperature,
+                          std::vector<Real> & e,
+                          std::vector<Real> & de_dp,
+                          std::vector<Real> & de_dT) const override;
+
   virtual Real mu_from_p_T(Real pressure, Real temperature) const override;
 
   virtual void mu_from_p_T(
@@ -51,6 +51,39 @@ InputParameters validParams<SinglePhaseFluidProperties>();
     d##want##d2 = tmp2;                                                                            \
   }
 
+/**
+ * Adds versions of a fluid property that evaluate a batch of states, such as all of the
+ * quadrature points of an element, in a single call. The defaults loop over the Real versions.
+ * Derived classes with closed-form expressions override them with plain loops over the inputs
+ * that avoid a virtual call per point and that the compiler can vectorize. Derived classes that
+ * only override the Real versions need a using declaration to keep these visible, so this is
+ * only added for rho_from_p_T and e_from_p_T, which have closed-form batched overrides.
+ */
+#define propfuncVector(want, prop1, prop2)                                                         \
+  virtual void want##_from_##prop1##_##prop2(const std::vector<Real> & prop1,                      \
+                                             const std::vector<Real> & prop2,                      \
+                                             std::vector<Real> & val) const                        \
+  {                                                                                                \
+    mooseAssert(prop1.size() == prop2.size(), "Input vectors must have the same size");            \
+    val.resize(prop1.size());                                                                      \
+    for (std::size_t i = 0; i < prop1.size(); ++i)                                                 \
+      val[i] = want##_from_##prop1##_##prop2(prop1[i], prop2[i]);                                  \
+  }                                                                                                \
+                                                                                                   \
+  virtual void want##_from_##prop1##_##prop2(const std::vector<Real> & prop1,                      \
+                                             const std::vector<Real> & prop2,                      \
+                                             std::vector<Real> & val,                              \
+                                             std::vector<Real> & d##want##d1,                      \
+                                             std::vector<Real> & d##want##d2) const                \
+  {                                                                                                \
+    mooseAssert(prop1.size() == prop2.size(), "Input vectors must have the same size");            \
+    val.resize(prop1.size());                                                                      \
+    d##want##d1.resize(prop1.size());                                                              \
+    d##want##d2.resize(prop1.size());                                                              \
+    for (std::size_t i = 0; i < prop1.size(); ++i)                                                 \
+      want##_from_##prop1##_##prop2(prop1[i], prop2[i], val[i], d##want##d1[i], d##want##d2[i]);   \
+  }
+
 /**
  * Adds function definitions with not implemented error. These functions should be overriden in
  * derived classes where required. AD versions are constructed automatically using propfuncAD.
@@ -150,6 +183,15 @@ public:
    * auto pressure = your_fluid_properties_object.p_from_v_e(v, e);
    * // pressure now contains partial derivatives w.r.t. all degrees of freedom
    * @endcode
+   *
+   * Batched versions of rho_from_p_T and e_from_p_T taking std::vector<Real> inputs evaluate
+   * many states at once, for example all of the quadrature points of an element. The outputs
+   * are resized to match the inputs:
+   *
+   * @begincode
+   * std::vector<Real> rho, drho_dp, drho_dT;
+   * your_fluid_properties_object.rho_from_p_T(pressures, temperatures, rho, drho_dp, drho_dT);
+   * @endcode
    */
   ///@{
   propfunc(p, v, e)
@@ -189,6 +231,8 @@ public:
   propfuncWithDefault(e, p, T)
   propfuncWithDefault(gamma, v, e)
   propfuncWithDefault(gamma, p, T)
+  propfuncVector(rho, p, T)
+  propfuncVector(e, p, T)
   ///@}
 
   // clang-format on
@@ -196,6 +240,7 @@ public:
 #undef propfunc
 #undef propfuncWithDefault
 #undef propfuncAD
+#undef propfuncVector
 
       /**
        * Fluid name
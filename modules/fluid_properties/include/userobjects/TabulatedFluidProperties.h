@@ -106,11 +106,15 @@ public:
   virtual void rho_from_p_T(
       Real pressure, Real temperature, Real & rho, Real & drho_dp, Real & drho_dT) const override;
 
+  using SinglePhaseFluidProperties::rho_from_p_T;
+
   virtual Real e_from_p_T(Real pressure, Real temperature) const override;
 
   virtual void
   e_from_p_T(Real pressure, Real temperature, Real & e, Real & de_dp, Real & de_dT) const override;
 
+  using SinglePhaseFluidProperties::e_from_p_T;
+
   virtual Real h_from_p_T(Real p, Real T) const override;
 
   virtual void
@@ -162,6 +166,8 @@ protected:
   /**
    * Generates a table of fluid properties by looping over pressure and temperature
    * and calculating properties using the FluidProperties UserObject _fp.
+   * The pressure rows are distributed over the processors, so this must be called
+   * on all processors.
    */
   virtual void generateTabulatedData();
 
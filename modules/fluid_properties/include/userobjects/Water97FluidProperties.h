@@ -63,11 +63,22 @@ public:
 
   virtual void rho_from_p_T(
       Real pressure, Real temperature, Real & rho, Real & drho_dp, Real & drho_dT) const override;
+  using SinglePhaseFluidProperties::rho_from_p_T;
 
   virtual Real e_from_p_T(Real pressure, Real temperature) const override;
 
   virtual void
   e_from_p_T(Real pressure, Real temperature, Real & e, Real & de_dp, Real & de_dT) const override;
+  using SinglePhaseFluidProperties::e_from_p_T;
+
+  virtual void rho_e_from_p_T(Real pressure,
+                              Real temperature,
+                              Real & rho,
+                              Real & drho_dp,
+                              Real & drho_dT,
+                              Real & e,
+                              Real & de_dp,
+                              Real & de_dT) const override;
 
   virtual Real c_from_p_T(Real pressure, Real temperature) const override;
 
@@ -43,6 +43,25 @@
     REL_TEST(df_da, df_da_fd, tol);                                                                \
   }
 
+// Macro for testing that the batched versions of f agree with f(a,b) at every entry of a and b
+#define BATCH_TEST(f, a, b, tol)                                                                   \
+  {                                                                                                \
+    std::vector<Real> f_batch, f_batch_deriv, df_da_batch, df_db_batch;                            \
+    f(a, b, f_batch);                                                                              \
+    f(a, b, f_batch_deriv, df_da_batch, df_db_batch);                                              \
+    EXPECT_EQ(f_batch.size(), a.size());                                                           \
+    EXPECT_EQ(f_batch_deriv.size(), a.size());                                                     \
+    for (std::size_t i = 0; i < a.size(); ++i)                                                     \
+    {                                                                                              \
+      Real f_value, df_da, df_db;                                                                  \
+      f(a[i], b[i], f_value, df_da, df_db);                                                        \
+      REL_TEST(f_batch[i], f_value, tol);                                                          \
+      REL_TEST(f_batch_deriv[i], f_value, tol);                                                    \
+      REL_TEST(df_da_batch[i], df_da, tol);                                                        \
+      REL_TEST(df_db_batch[i], df_db, tol);                                                        \
+    }                                                                                              \
+  }
+
 // Macro for testing that a "not implemented" error message is thrown for f(a,b)
 #define NOT_IMPLEMENTED_TEST_VALUE(f)                                                              \
   {                                                                                                \
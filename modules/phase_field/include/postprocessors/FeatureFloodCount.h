@@ -18,6 +18,7 @@
 #include <iterator>
 #include <list>
 #include <set>
+#include <unordered_map>
 #include <vector>
 
 #include "libmesh/mesh_tools.h"
@@ -388,6 +389,17 @@ protected:
                                              Status & status,
                                              unsigned int & new_id);
 
+  /**
+   * Whether or not the entity has already been marked as part of a feature in the given map
+   * during the current flood.
+   */
+  virtual bool isEntityVisited(std::size_t current_index, dof_id_type entity_id) const;
+
+  /**
+   * Marks the entity as part of a feature in the given map so it isn't visited again.
+   */
+  virtual void markEntityVisited(std::size_t current_index, dof_id_type entity_id);
+
   /**
    * This method takes all of the partial features and expands the local, ghosted, and halo sets
    * around those regions to account for the diffuse interface. Rather than using any kind of
@@ -620,12 +632,16 @@ protected:
   const processor_id_type _n_procs;
 
   /**
-   * This variable keeps track of which nodes have been visited during execution.  We don't use the
-   * _feature_map for this since we don't want to explicitly store data for all the unmarked nodes
-   * in a serialized datastructures.
-   * This keeps our overhead down since this variable never needs to be communicated.
+   * This variable keeps track of which entities have been visited during execution.  We don't use
+   * the _feature_map for this since we don't want to explicitly store data for all the unmarked
+   * nodes in a serialized datastructures.
+   * The flags are indexed by the local entity index from _entity_id_to_local_index so they only
+   * cover the entities present on this processor. This variable never needs to be communicated.
    */
-  std::vector<std::set<dof_id_type>> _entities_visited;
+  std::vector<std::vector<bool>> _entities_visited;
+
+  /// Compact index of every element (or node) present on this processor, rebuilt in meshChanged()
+  std::unordered_map<dof_id_type, std::size_t> _entity_id_to_local_index;
 
   /**
    * This map keeps track of which variables own which nodes.  We need a vector of them for multimap
@@ -107,6 +107,8 @@ protected:
                                              FeatureData *& feature,
                                              Status & status,
                                              unsigned int & new_id) override;
+  virtual bool isEntityVisited(std::size_t current_index, dof_id_type entity_id) const override;
+  virtual void markEntityVisited(std::size_t current_index, dof_id_type entity_id) override;
   virtual void mergeSets() override;
 
   /**
@@ -170,5 +172,11 @@ private:
   std::vector<unsigned int> _prealloc_tmp_grains;
 
   std::map<dof_id_type, std::vector<unsigned int>> _entity_to_grain_cache;
+
+  /**
+   * The entities visited while building the IC. We need one set per grain to support overlapping
+   * features. Luckily, this is a fairly sparse structure.
+   */
+  std::vector<std::set<dof_id_type>> _grain_entities_visited;
 };
 
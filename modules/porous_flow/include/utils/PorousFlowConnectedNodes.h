@@ -135,12 +135,10 @@ private:
   bool _still_adding_global_nodes;
   dof_id_type _min_global_id;
   dof_id_type _max_global_id;
-  std::set<dof_id_type> _set_of_global_ids;
   std::vector<dof_id_type> _global_id;
   std::vector<dof_id_type> _sequential_id;
 
   bool _still_adding_connections;
-  std::vector<std::set<dof_id_type>> _neighbor_sets;
   std::vector<std::vector<dof_id_type>> _sequential_neighbors;
   std::vector<std::vector<dof_id_type>> _global_neighbors;
 };
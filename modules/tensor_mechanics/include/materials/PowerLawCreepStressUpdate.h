@@ -37,6 +37,9 @@ protected:
   virtual Real computeResidual(const Real effective_trial_stress, const Real scalar) override;
   virtual Real computeDerivative(const Real effective_trial_stress, const Real scalar) override;
 
+  /// Returns stress_delta^(n_exponent - 1), reusing the value from the previous call if possible
+  Real stressDeltaPower(const Real stress_delta);
+
   /// Flag to determine if temperature is supplied by the user
   const bool _has_temp;
 
@@ -66,5 +69,11 @@ protected:
 
   /// Exponential calculated from current time
   Real _exp_time;
+
+  /// Stress difference for which _cached_stress_delta_power was last computed
+  Real _cached_stress_delta;
+
+  /// Cached value of _cached_stress_delta^(n_exponent - 1)
+  Real _cached_stress_delta_power;
 };
 
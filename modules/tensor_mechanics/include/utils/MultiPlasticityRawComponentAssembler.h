@@ -15,6 +15,7 @@
 /****************************************************************/
 
 #include "TensorMechanicsPlasticModel.h"
+#include "RankFourTensor.h"
 #include "UserObjectInterface.h"
 
 class MultiPlasticityRawComponentAssembler;
@@ -328,5 +329,16 @@ private:
                                    const std::vector<Real> & intnl,
                                    const RankFourTensor & Eijkl,
                                    std::vector<bool> & act);
+
+  /**
+   * Scratch space used by yieldFunction, flowPotential, etc, to hold the active surfaces of a
+   * model and that model's raw output.  These methods are called many times per quadpoint
+   * during the return-map, so this avoids a heap allocation for each call.  Each material has
+   * its own copy per thread, so no synchronisation is needed.
+   */
+  std::vector<unsigned int> _active_surfaces_scratch;
+  std::vector<Real> _model_real_scratch;
+  std::vector<RankTwoTensor> _model_r2_scratch;
+  std::vector<RankFourTensor> _model_r4_scratch;
 };
 
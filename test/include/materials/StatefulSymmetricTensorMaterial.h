@@ -0,0 +1,51 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#pragma once
+
+#include "Material.h"
+#include "SymmetricRankTwoTensor.h"
+#include "SymmetricRankFourTensor.h"
+
+// Forward Declarations
+class StatefulSymmetricTensorMaterial;
+
+template <>
+InputParameters validParams<StatefulSymmetricTensorMaterial>();
+
+/**
+ * Stateful material that adds a fixed increment to symmetric rank two and rank four tensor
+ * properties every time step and checks that their old values match a stateful Real counter.
+ */
+class StatefulSymmetricTensorMaterial : public Material
+{
+public:
+  StatefulSymmetricTensorMaterial(const InputParameters & parameters);
+
+protected:
+  virtual void initQpStatefulProperties() override;
+  virtual void computeQpProperties() override;
+
+private:
+  /// The increment added to the rank two tensor each time step
+  SymmetricRankTwoTensor _stress_increment;
+
+  /// The increment added to the rank four tensor each time step
+  SymmetricRankFourTensor _elasticity_increment;
+
+  /// Number of increments added to the tensors
+  MaterialProperty<Real> & _count;
+  const MaterialProperty<Real> & _count_old;
+
+  MaterialProperty<SymmetricRankTwoTensor> & _stress;
+  const MaterialProperty<SymmetricRankTwoTensor> & _stress_old;
+
+  MaterialProperty<SymmetricRankFourTensor> & _elasticity;
+  const MaterialProperty<SymmetricRankFourTensor> & _elasticity_old;
+};
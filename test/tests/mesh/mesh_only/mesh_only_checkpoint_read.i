@@ -0,0 +1,8 @@
+[Mesh]
+  type = FileMesh
+  file = mesh_only_checkpoint.cpr
+[]
+
+# This input file reads back the checkpoint mesh written by the "mesh_only_checkpoint"
+# test and is intended to be run with the "--mesh-only" option so no other sections
+# are required
@@ -0,0 +1,62 @@
+[Mesh]
+  type = GeneratedMesh
+  dim = 2
+  nx = 4
+  ny = 4
+[]
+
+[Variables]
+  [./u]
+  [../]
+[]
+
+[Kernels]
+  [./diff]
+    type = Diffusion
+    variable = u
+  [../]
+  [./td]
+    type = TimeDerivative
+    variable = u
+  [../]
+[]
+
+[BCs]
+  [./left]
+    type = DirichletBC
+    variable = u
+    boundary = left
+    value = 0
+  [../]
+  [./right]
+    type = DirichletBC
+    variable = u
+    boundary = right
+    value = 1
+  [../]
+[]
+
+[Executioner]
+  type = Transient
+  num_steps = 3
+  dt = 1
+
+  solve_type = 'PJFNK'
+
+  petsc_options_iname = '-pc_type'
+  petsc_options_value = 'lu'
+[]
+
+[MultiApps]
+  [./sub]
+    type = FullSolveMultiApp
+    app_type = MooseTestApp
+    execute_on = timestep_end
+    positions = '0 0 0  1 0 0  2 0 0  3 0 0'
+    input_files = sub_steady.i
+    # The first App is much more expensive than the others
+    cli_args = 'Mesh/nx=200;Mesh/ny=200 Mesh/nx=4 Mesh/nx=4 Mesh/nx=4'
+    rebalance_apps = true
+    rebalance_tolerance = 0
+  [../]
+[]